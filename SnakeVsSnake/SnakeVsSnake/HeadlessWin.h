@@ -0,0 +1,94 @@
+// Sustituto minimo de <windows.h> para compilar Game.h sin WinAPI (se activa con SNAKE_HEADLESS).
+// Solo declara lo que usa el juego: el reloj es virtual y el HDC es una superficie en memoria.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+typedef std::uint32_t DWORD;
+typedef std::uint32_t COLORREF;
+typedef long LONG;
+typedef unsigned int UINT;
+typedef int BOOL;
+
+#define RGB(r, g, b) ((COLORREF)(((std::uint8_t)(r)) | ((DWORD)((std::uint8_t)(g)) << 8) | ((DWORD)((std::uint8_t)(b)) << 16)))
+
+#define TRANSPARENT 1
+#define DT_CENTER 0x00000001
+#define DT_VCENTER 0x00000004
+#define DT_SINGLELINE 0x00000020
+
+struct RECT {
+    LONG left, top, right, bottom;
+};
+
+// Reloj virtual en milisegundos; quien lo usa lo avanza a mano para que las partidas sean reproducibles
+inline DWORD& HeadlessTickCount() {
+    static DWORD ticks = 0;
+    return ticks;
+}
+
+inline DWORD GetTickCount() {
+    return HeadlessTickCount();
+}
+
+// Superficie de dibujo en memoria que hace de HDC
+struct HeadlessSurface {
+    int width, height;
+    std::vector<COLORREF> pixels;
+    COLORREF textColor;
+    int bkMode;
+    int textCalls;
+
+    HeadlessSurface(int w, int h) : width(w), height(h), pixels(static_cast<size_t>(w) * h, 0),
+        textColor(0), bkMode(0), textCalls(0) {}
+};
+typedef HeadlessSurface* HDC;
+
+struct HeadlessBrush {
+    COLORREF color;
+};
+typedef HeadlessBrush* HBRUSH;
+
+inline HBRUSH CreateSolidBrush(COLORREF color) {
+    return new HeadlessBrush{ color };
+}
+
+inline BOOL DeleteObject(HBRUSH brush) {
+    delete brush;
+    return 1;
+}
+
+// Rellena el rectangulo recortado a la superficie
+inline int FillRect(HDC hdc, const RECT* r, HBRUSH brush) {
+    int left = std::max<int>(0, r->left);
+    int top = std::max<int>(0, r->top);
+    int right = std::min<int>(hdc->width, r->right);
+    int bottom = std::min<int>(hdc->height, r->bottom);
+    if (left >= right || top >= bottom)
+        return 1;
+    for (int y = top; y < bottom; y++) {
+        COLORREF* row = hdc->pixels.data() + static_cast<size_t>(y) * hdc->width;
+        std::fill(row + left, row + right, brush->color);
+    }
+    return 1;
+}
+
+inline COLORREF SetTextColor(HDC hdc, COLORREF color) {
+    COLORREF previous = hdc->textColor;
+    hdc->textColor = color;
+    return previous;
+}
+
+inline int SetBkMode(HDC hdc, int mode) {
+    int previous = hdc->bkMode;
+    hdc->bkMode = mode;
+    return previous;
+}
+
+// No rasteriza texto; solo cuenta las llamadas
+inline int DrawText(HDC hdc, const wchar_t*, int, RECT*, UINT) {
+    hdc->textCalls++;
+    return 1;
+}
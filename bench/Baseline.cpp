@@ -0,0 +1,335 @@
+#include "Baseline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+const int kBaselineFormat = 1;
+
+// Valor JSON minimo: basta para leer lo que escribe WriteBaseline
+struct JsonValue {
+    enum Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+    Type type;
+    bool boolean;
+    double number;
+    std::string str;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    JsonValue() : type(NUL), boolean(false), number(0) {}
+
+    const JsonValue* Find(const std::string& key) const {
+        for (auto& m : members) {
+            if (m.first == key)
+                return &m.second;
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : text(text), pos(0) {}
+
+    bool Parse(JsonValue& out, std::string& error) {
+        if (!ParseValue(out, 0) || (SkipSpaces(), pos != text.size())) {
+            error = "JSON invalido cerca de la posicion " + std::to_string(pos);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    const std::string& text;
+    size_t pos;
+
+    void SkipSpaces() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\n' || text[pos] == '\r' || text[pos] == '\t'))
+            pos++;
+    }
+
+    bool Consume(char c) {
+        SkipSpaces();
+        if (pos < text.size() && text[pos] == c) {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeWord(const char* word) {
+        size_t len = std::char_traits<char>::length(word);
+        if (text.compare(pos, len, word) != 0)
+            return false;
+        pos += len;
+        return true;
+    }
+
+    bool ParseString(std::string& out) {
+        if (!Consume('"'))
+            return false;
+        out.clear();
+        while (pos < text.size() && text[pos] != '"') {
+            char c = text[pos++];
+            if (c == '\\') {
+                if (pos >= text.size())
+                    return false;
+                char e = text[pos++];
+                switch (e) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case '"': case '\\': case '/': out += e; break;
+                default: return false;
+                }
+            }
+            else {
+                out += c;
+            }
+        }
+        if (pos >= text.size())
+            return false;
+        pos++;
+        return true;
+    }
+
+    bool ParseValue(JsonValue& out, int depth) {
+        if (depth > 32)
+            return false;
+        SkipSpaces();
+        if (pos >= text.size())
+            return false;
+        char c = text[pos];
+        if (c == '{') {
+            pos++;
+            out.type = JsonValue::OBJECT;
+            if (Consume('}'))
+                return true;
+            do {
+                std::pair<std::string, JsonValue> member;
+                if (!ParseString(member.first) || !Consume(':') || !ParseValue(member.second, depth + 1))
+                    return false;
+                out.members.push_back(std::move(member));
+            } while (Consume(','));
+            return Consume('}');
+        }
+        if (c == '[') {
+            pos++;
+            out.type = JsonValue::ARRAY;
+            if (Consume(']'))
+                return true;
+            do {
+                out.items.emplace_back();
+                if (!ParseValue(out.items.back(), depth + 1))
+                    return false;
+            } while (Consume(','));
+            return Consume(']');
+        }
+        if (c == '"') {
+            out.type = JsonValue::STRING;
+            return ParseString(out.str);
+        }
+        if (ConsumeWord("true")) {
+            out.type = JsonValue::BOOLEAN;
+            out.boolean = true;
+            return true;
+        }
+        if (ConsumeWord("false")) {
+            out.type = JsonValue::BOOLEAN;
+            out.boolean = false;
+            return true;
+        }
+        if (ConsumeWord("null")) {
+            out.type = JsonValue::NUL;
+            return true;
+        }
+        const char* begin = text.c_str() + pos;
+        char* end = nullptr;
+        out.number = std::strtod(begin, &end);
+        if (end == begin)
+            return false;
+        out.type = JsonValue::NUMBER;
+        pos += end - begin;
+        return true;
+    }
+};
+
+bool ReadNumber(const JsonValue& object, const char* key, double& out) {
+    const JsonValue* v = object.Find(key);
+    if (!v || v->type != JsonValue::NUMBER)
+        return false;
+    out = v->number;
+    return true;
+}
+
+std::string FormatNumber(double value) {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+} // namespace
+
+MetricSummary Summarize(const std::string& name, std::vector<double> values) {
+    MetricSummary s = { name, static_cast<int>(values.size()), 0, 0, 0, 0, 0 };
+    if (values.empty())
+        return s;
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    s.median = (n % 2) ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+    s.min = values.front();
+    s.max = values.back();
+    double sum = 0;
+    for (double v : values)
+        sum += v;
+    s.mean = sum / n;
+    if (n > 1) {
+        double squares = 0;
+        for (double v : values)
+            squares += (v - s.mean) * (v - s.mean);
+        s.stddev = std::sqrt(squares / (n - 1));
+    }
+    return s;
+}
+
+bool WriteBaseline(const std::string& path, const Baseline& baseline, std::string& error) {
+    std::ofstream out(path);
+    if (!out) {
+        error = "no se pudo abrir " + path + " para escritura";
+        return false;
+    }
+    out << "{\n";
+    out << "  \"format\": " << kBaselineFormat << ",\n";
+    out << "  \"ticks\": " << baseline.ticks << ",\n";
+    out << "  \"reps\": " << baseline.reps << ",\n";
+    out << "  \"warmup\": " << baseline.warmup << ",\n";
+    out << "  \"scenarios\": {";
+    for (size_t i = 0; i < baseline.checksums.size(); i++) {
+        char hex[32];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(baseline.checksums[i].second));
+        out << (i ? ",\n" : "\n") << "    \"" << baseline.checksums[i].first << "\": { \"checksum\": \"" << hex << "\" }";
+    }
+    out << "\n  },\n";
+    out << "  \"metrics\": {";
+    for (size_t i = 0; i < baseline.metrics.size(); i++) {
+        const MetricSummary& m = baseline.metrics[i];
+        out << (i ? ",\n" : "\n") << "    \"" << m.name << "\": { "
+            << "\"samples\": " << m.samples
+            << ", \"median\": " << FormatNumber(m.median)
+            << ", \"mean\": " << FormatNumber(m.mean)
+            << ", \"stddev\": " << FormatNumber(m.stddev)
+            << ", \"min\": " << FormatNumber(m.min)
+            << ", \"max\": " << FormatNumber(m.max) << " }";
+    }
+    out << "\n  }\n}\n";
+    out.flush();
+    if (!out) {
+        error = "error al escribir " + path;
+        return false;
+    }
+    return true;
+}
+
+bool LoadBaseline(const std::string& path, Baseline& baseline, std::string& error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "no se pudo abrir " + path;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+
+    JsonValue root;
+    JsonParser parser(text);
+    if (!parser.Parse(root, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    double format = 0, ticks = 0, reps = 0, warmup = 0;
+    if (root.type != JsonValue::OBJECT || !ReadNumber(root, "format", format) || format != kBaselineFormat ||
+        !ReadNumber(root, "ticks", ticks) || !ReadNumber(root, "reps", reps) || !ReadNumber(root, "warmup", warmup)) {
+        error = path + ": cabecera de linea base no reconocida";
+        return false;
+    }
+    baseline = Baseline();
+    baseline.ticks = static_cast<int>(ticks);
+    baseline.reps = static_cast<int>(reps);
+    baseline.warmup = static_cast<int>(warmup);
+
+    const JsonValue* scenarios = root.Find("scenarios");
+    if (scenarios && scenarios->type == JsonValue::OBJECT) {
+        for (auto& s : scenarios->members) {
+            const JsonValue* checksum = s.second.Find("checksum");
+            if (!checksum || checksum->type != JsonValue::STRING) {
+                error = path + ": escenario " + s.first + " sin checksum";
+                return false;
+            }
+            std::uint64_t value = std::strtoull(checksum->str.c_str(), nullptr, 16);
+            baseline.checksums.push_back({ s.first, value });
+        }
+    }
+
+    const JsonValue* metrics = root.Find("metrics");
+    if (!metrics || metrics->type != JsonValue::OBJECT) {
+        error = path + ": falta el objeto \"metrics\"";
+        return false;
+    }
+    for (auto& m : metrics->members) {
+        MetricSummary s = { m.first, 0, 0, 0, 0, 0, 0 };
+        double samples = 0;
+        if (!ReadNumber(m.second, "samples", samples) || !ReadNumber(m.second, "median", s.median) ||
+            !ReadNumber(m.second, "mean", s.mean) || !ReadNumber(m.second, "stddev", s.stddev) ||
+            !ReadNumber(m.second, "min", s.min) || !ReadNumber(m.second, "max", s.max)) {
+            error = path + ": metrica " + m.first + " incompleta";
+            return false;
+        }
+        s.samples = static_cast<int>(samples);
+        baseline.metrics.push_back(s);
+    }
+    return true;
+}
+
+std::vector<Comparison> CompareToBaseline(const Baseline& baseline, const std::vector<MetricSummary>& current,
+    const GateSettings& settings) {
+    std::vector<Comparison> result;
+    for (auto& cur : current) {
+        Comparison c = { cur.name, 0, cur.median, 0, 0, COMPARE_NEW };
+        auto base = std::find_if(baseline.metrics.begin(), baseline.metrics.end(),
+            [&](const MetricSummary& m) { return m.name == cur.name; });
+        if (base == baseline.metrics.end()) {
+            result.push_back(c);
+            continue;
+        }
+        c.baseMedian = base->median;
+        c.change = (base->median > 0) ? cur.median / base->median - 1 : 0;
+
+        // Welch: no supone varianzas iguales entre la linea base y la medicion actual
+        double diff = cur.mean - base->mean;
+        double se = 0;
+        if (cur.samples > 0)
+            se += cur.stddev * cur.stddev / cur.samples;
+        if (base->samples > 0)
+            se += base->stddev * base->stddev / base->samples;
+        if (se > 0)
+            c.tStat = diff / std::sqrt(se);
+        else if (diff != 0)
+            c.tStat = (diff > 0) ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
+
+        double delta = cur.median - base->median;
+        if (c.change > settings.threshold && delta > settings.minDeltaNs && c.tStat > settings.tCritical)
+            c.status = COMPARE_REGRESSION;
+        else if (c.change < -settings.threshold && -delta > settings.minDeltaNs && c.tStat < -settings.tCritical)
+            c.status = COMPARE_FASTER;
+        else
+            c.status = COMPARE_OK;
+        result.push_back(c);
+    }
+    return result;
+}
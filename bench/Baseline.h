@@ -0,0 +1,54 @@
+// Estadisticas de las mediciones y comparacion contra una linea base guardada en JSON.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Resumen de las repeticiones de una metrica (ns por tick)
+struct MetricSummary {
+    std::string name;        // "<escenario>/<metrica>"
+    int samples;
+    double median;
+    double mean;
+    double stddev;
+    double min;
+    double max;
+};
+
+MetricSummary Summarize(const std::string& name, std::vector<double> values);
+
+struct Baseline {
+    int ticks;               // Ticks por repeticion; solo se compara con la misma carga
+    int reps;
+    int warmup;
+    std::vector<std::pair<std::string, std::uint64_t>> checksums; // Estado final de cada escenario
+    std::vector<MetricSummary> metrics;
+
+    Baseline() : ticks(0), reps(0), warmup(0) {}
+};
+
+// Devuelven false y rellenan error si no se pudo escribir o leer el fichero
+bool WriteBaseline(const std::string& path, const Baseline& baseline, std::string& error);
+bool LoadBaseline(const std::string& path, Baseline& baseline, std::string& error);
+
+struct GateSettings {
+    double threshold;        // Aumento relativo de la mediana tolerado (0.10 = 10%)
+    double minDeltaNs;       // Diferencias absolutas menores se consideran ruido
+    double tCritical;        // Umbral del estadistico t de Welch para considerar el cambio significativo
+};
+
+enum CompareStatus { COMPARE_OK, COMPARE_FASTER, COMPARE_REGRESSION, COMPARE_NEW };
+
+struct Comparison {
+    std::string name;
+    double baseMedian;
+    double currentMedian;
+    double change;           // Cambio relativo de la mediana
+    double tStat;            // Positivo si la medicion actual es mas lenta
+    CompareStatus status;
+};
+
+std::vector<Comparison> CompareToBaseline(const Baseline& baseline, const std::vector<MetricSummary>& current,
+    const GateSettings& settings);
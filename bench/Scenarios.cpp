@@ -0,0 +1,271 @@
+#include "Scenarios.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+// Esquina superior izquierda de la celda (col, row) del area jugable
+Point Cell(int col, int row) {
+    return { BORDER_MARGIN + col * GRID_SIZE, BORDER_MARGIN + row * GRID_SIZE };
+}
+
+Point Step(Point p, Direction d) {
+    switch (d) {
+    case UP:    p.y -= GRID_SIZE; break;
+    case DOWN:  p.y += GRID_SIZE; break;
+    case LEFT:  p.x -= GRID_SIZE; break;
+    case RIGHT: p.x += GRID_SIZE; break;
+    }
+    return p;
+}
+
+Direction Opposite(Direction d) {
+    switch (d) {
+    case UP:    return DOWN;
+    case DOWN:  return UP;
+    case LEFT:  return RIGHT;
+    default:    return LEFT;
+    }
+}
+
+Direction TurnRight(Direction d) {
+    switch (d) {
+    case UP:    return RIGHT;
+    case RIGHT: return DOWN;
+    case DOWN:  return LEFT;
+    default:    return UP;
+    }
+}
+
+// Recorre filas completas en zigzag: la primera en el sentido indicado y las siguientes alternando
+std::vector<Point> Zigzag(int firstRow, int rowStep, int rowCount, bool leftToRight) {
+    std::vector<Point> cells;
+    for (int r = 0; r < rowCount; r++) {
+        int row = firstRow + r * rowStep;
+        bool forward = (r % 2 == 0) ? leftToRight : !leftToRight;
+        for (int i = 0; i < numCols; i++)
+            cells.push_back(Cell(forward ? i : numCols - 1 - i, row));
+    }
+    return cells;
+}
+
+// Serpiente con la cabeza en head seguida de los primeros tailLength puntos de tail
+Snake MakeSnake(Point head, Direction dir, const std::vector<Point>& tail, size_t tailLength, COLORREF color) {
+    Snake s(head.x, head.y, color);
+    s.body.assign(1, head);
+    s.body.insert(s.body.end(), tail.begin(), tail.begin() + std::min(tailLength, tail.size()));
+    s.dir = dir;
+    s.lastEaten = 0;
+    return s;
+}
+
+// Enemigo enroscado: las tres salidas de la cabeza (mirando a la derecha) son parte de su cuerpo,
+// asi que UpdateEnemy no encuentra direccion segura y el enemigo choca consigo mismo.
+std::vector<Point> CoilBody(int col, int row) {
+    return { Cell(col, row), Cell(col - 1, row), Cell(col - 1, row + 1), Cell(col, row + 1),
+             Cell(col + 1, row + 1), Cell(col + 1, row), Cell(col + 1, row - 1), Cell(col, row - 1),
+             Cell(col - 1, row - 1), Cell(col - 2, row - 1), Cell(col - 3, row - 1), Cell(col - 4, row - 1) };
+}
+
+bool OnBody(const Snake& s, Point p) {
+    for (auto& b : s.body) {
+        if (b.x == p.x && b.y == p.y)
+            return true;
+    }
+    return false;
+}
+
+bool IsCellFree(const Game& game, Point p) {
+    if (p.x < BORDER_MARGIN || p.x >= BORDER_MARGIN + PLAYABLE_WIDTH ||
+        p.y < BORDER_MARGIN || p.y >= BORDER_MARGIN + PLAYABLE_HEIGHT)
+        return false;
+    if (OnBody(*game.player, p))
+        return false;
+    return !(game.enemy && OnBody(*game.enemy, p));
+}
+
+// Anade alimento en las celdas dadas que no esten ocupadas por ninguna serpiente
+void AddFoods(GameSnapshot& s, const std::vector<Point>& cells) {
+    for (auto& p : cells) {
+        if (OnBody(s.player, p) || (s.enemy && OnBody(*s.enemy, p)))
+            continue;
+        s.foods.push_back(Food(p.x, p.y));
+    }
+}
+
+// Jugador en la esquina superior izquierda, entrando por el borde izquierdo en sentido horario
+Snake CornerPlayer(size_t length) {
+    std::vector<Point> tail;
+    for (int col = 4; col >= 0; col--)
+        tail.push_back(Cell(col, 0));
+    for (int row = 1; row < numRows; row++)
+        tail.push_back(Cell(0, row));
+    return MakeSnake(Cell(5, 0), RIGHT, tail, length - 1, RGB(0, 255, 0));
+}
+
+void DriveSteer(Game& game) {
+    SteerPlayer(game);
+}
+
+// Enrosca al enemigo vivo para que muera este tick; si esta muerto adelanta el reloj hasta su reaparicion
+void DriveRespawnCycle(Game& game) {
+    SteerPlayer(game);
+    if (game.enemy) {
+        game.enemy->body = CoilBody(numCols / 2, numRows / 2);
+        game.enemy->dir = RIGHT;
+    }
+    else if (HeadlessTickCount() < game.enemyRespawnTime) {
+        HeadlessTickCount() = game.enemyRespawnTime;
+    }
+}
+
+// Apunta al enemigo hacia su propio cuello para forzar la rama de direccion insegura de UpdateEnemy
+void DriveUnsafeStorm(Game& game) {
+    SteerPlayer(game);
+    if (!game.enemy || game.enemy->body.size() < 2)
+        return;
+    Point head = game.enemy->body[0];
+    Point neck = game.enemy->body[1];
+    if (neck.x > head.x) game.enemy->dir = RIGHT;
+    else if (neck.x < head.x) game.enemy->dir = LEFT;
+    else if (neck.y > head.y) game.enemy->dir = DOWN;
+    else if (neck.y < head.y) game.enemy->dir = UP;
+}
+
+Scenario LongSnakes() {
+    // Dos serpientes de 353 segmentos ocupan 22 de las 24 filas; solo quedan libres las filas 11 y 12
+    GameSnapshot s(MakeSnake(Cell(0, 11), RIGHT, Zigzag(10, -1, 11, true), 1000, RGB(0, 255, 0)));
+    s.enemy = MakeSnake(Cell(numCols - 1, 12), LEFT, Zigzag(13, 1, 11, false), 1000, RGB(0, 0, 255));
+    std::vector<Point> cells;
+    for (int col = 0; col < 16; col += 2)
+        cells.push_back(Cell(col, 12));
+    AddFoods(s, cells);
+    return { "long_snakes", "Serpientes de 353 segmentos con el tablero casi lleno", 1u, 100, s, DriveSteer, true };
+}
+
+Scenario CrowdedFood() {
+    // Alimento en la mitad de las celdas libres (tablero de ajedrez)
+    GameSnapshot s(MakeSnake(Cell(0, 4), RIGHT, Zigzag(3, -1, 4, true), 39, RGB(0, 255, 0)));
+    s.enemy = MakeSnake(Cell(numCols - 1, 19), LEFT, Zigzag(20, 1, 4, false), 39, RGB(0, 0, 255));
+    std::vector<Point> cells;
+    for (int row = 0; row < numRows; row++) {
+        for (int col = 0; col < numCols; col++) {
+            if ((col + row) % 2 == 0)
+                cells.push_back(Cell(col, row));
+        }
+    }
+    AddFoods(s, cells);
+    return { "crowded_food", "Cientos de alimentos y serpientes de 40 segmentos", 2u, 100, s, DriveSteer, true };
+}
+
+Scenario EnemyRespawnCycle() {
+    GameSnapshot s(CornerPlayer(20));
+    std::vector<Point> coil = CoilBody(numCols / 2, numRows / 2);
+    s.enemy = MakeSnake(coil[0], RIGHT, std::vector<Point>(coil.begin() + 1, coil.end()), coil.size(), RGB(0, 0, 255));
+    std::vector<Point> cells;
+    for (int col = 8; col <= 24; col += 4) {
+        cells.push_back(Cell(col, 6));
+        cells.push_back(Cell(col, 18));
+    }
+    AddFoods(s, cells);
+    return { "enemy_respawn", "El enemigo muere y reaparece en ticks alternos", 3u, 100, s, DriveRespawnCycle, false };
+}
+
+Scenario UnsafeStorm() {
+    // Enemigo de 161 segmentos plegado en las filas inferiores que cada tick apunta a su cuello
+    GameSnapshot s(CornerPlayer(10));
+    s.enemy = MakeSnake(Cell(0, 15), UP, Zigzag(16, 1, 8, true), 160, RGB(0, 0, 255));
+    std::vector<Point> cells;
+    for (int row = 4; row <= 12; row += 2) {
+        for (int col = 2; col < numCols; col += 4)
+            cells.push_back(Cell(col, row));
+    }
+    AddFoods(s, cells);
+    return { "unsafe_storm", "UpdateEnemy entra en la rama de direccion insegura en cada tick", 4u, 100, s, DriveUnsafeStorm, false };
+}
+
+void Mix(std::uint64_t& hash, std::int64_t value) {
+    for (int i = 0; i < 8; i++) {
+        hash ^= static_cast<std::uint64_t>(value >> (i * 8)) & 0xff;
+        hash *= 1099511628211ull;
+    }
+}
+
+void MixSnake(std::uint64_t& hash, const Snake& s) {
+    Mix(hash, s.dir);
+    Mix(hash, static_cast<std::int64_t>(s.body.size()));
+    for (auto& p : s.body) {
+        Mix(hash, p.x);
+        Mix(hash, p.y);
+    }
+    Mix(hash, s.lastEaten);
+}
+
+} // namespace
+
+std::vector<Scenario> BuildScenarios() {
+    HeadlessTickCount() = 0;
+    return { LongSnakes(), CrowdedFood(), EnemyRespawnCycle(), UnsafeStorm() };
+}
+
+void RestoreScenario(Game& game, const Scenario& scenario) {
+    const GameSnapshot& s = scenario.start;
+    std::srand(scenario.seed);
+    HeadlessTickCount() = s.clock;
+    *game.player = s.player;
+    if (s.enemy) {
+        if (game.enemy)
+            *game.enemy = *s.enemy;
+        else
+            game.enemy = new Snake(*s.enemy);
+    }
+    else if (game.enemy) {
+        delete game.enemy;
+        game.enemy = nullptr;
+    }
+    game.foods = s.foods;
+    game.foodSpawnInterval = s.foodSpawnInterval;
+    game.lastFoodSpawn = s.lastFoodSpawn;
+    game.enemyRespawnTime = s.enemyRespawnTime;
+    game.gameOver = false;
+    game.highlightPlayerImpact = false;
+    game.playerImpactPos = { 0, 0 };
+    game.highlightEnemyImpact = false;
+    game.enemyImpactPos = { 0, 0 };
+}
+
+void SteerPlayer(Game& game) {
+    Snake* p = game.player;
+    Direction forward = p->dir;
+    Direction options[3] = { forward, TurnRight(forward), Opposite(TurnRight(forward)) };
+    for (Direction d : options) {
+        if (IsCellFree(game, Step(p->body[0], d))) {
+            if (d != forward) {
+                p->pendingDir = d;
+                p->hasPending = true;
+            }
+            return;
+        }
+    }
+}
+
+std::uint64_t StateChecksum(const Game& game) {
+    std::uint64_t hash = 14695981039346656037ull;
+    MixSnake(hash, *game.player);
+    Mix(hash, game.enemy != nullptr);
+    if (game.enemy)
+        MixSnake(hash, *game.enemy);
+    Mix(hash, static_cast<std::int64_t>(game.foods.size()));
+    for (auto& f : game.foods) {
+        Mix(hash, f.pos.x);
+        Mix(hash, f.pos.y);
+    }
+    Mix(hash, game.foodSpawnInterval);
+    Mix(hash, game.lastFoodSpawn);
+    Mix(hash, game.enemyRespawnTime);
+    Mix(hash, game.gameOver);
+    Mix(hash, game.highlightPlayerImpact);
+    Mix(hash, game.highlightEnemyImpact);
+    return hash;
+}
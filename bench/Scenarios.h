@@ -0,0 +1,49 @@
+// Escenarios deterministas para los benchmarks: estado inicial, semilla y un
+// "conductor" que prepara cada tick fuera de la zona medida.
+#pragma once
+
+#include "Game.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Copia por valor del estado de una partida
+struct GameSnapshot {
+    Snake player;
+    std::optional<Snake> enemy;
+    std::vector<Food> foods;
+    int foodSpawnInterval;
+    DWORD lastFoodSpawn;
+    DWORD enemyRespawnTime;
+    DWORD clock;             // Valor inicial del reloj virtual
+
+    GameSnapshot(const Snake& p) : player(p), foodSpawnInterval(2000), lastFoodSpawn(0),
+        enemyRespawnTime(0), clock(0) {}
+};
+
+// Ajustes previos a cada tick (no se miden)
+typedef void (*ScenarioDriver)(Game& game);
+
+struct Scenario {
+    std::string name;
+    std::string description;
+    unsigned seed;           // Semilla de std::rand (SpawnFood)
+    DWORD tickMs;            // Avance del reloj virtual por tick (el juego usa 100)
+    GameSnapshot start;
+    ScenarioDriver driver;   // Puede ser nullptr
+    bool restartOnEnemyDeath; // Reinicia el escenario si muere el enemigo para no perder su longitud
+};
+
+// Devuelve todos los escenarios en un orden fijo
+std::vector<Scenario> BuildScenarios();
+
+// Deja la partida y el reloj virtual exactamente como al inicio del escenario
+void RestoreScenario(Game& game, const Scenario& scenario);
+
+// Gira al jugador si seguir recto lo haria chocar (preferencia en sentido horario)
+void SteerPlayer(Game& game);
+
+// Huella del estado de la partida para comprobar que dos ejecuciones coinciden
+std::uint64_t StateChecksum(const Game& game);
@@ -0,0 +1,342 @@
+// Benchmark de la logica del juego sin ventana: ejecuta escenarios deterministas, mide
+// Game::Update, cada una de sus fases y un Render sobre una superficie en memoria, y
+// compara los resultados con una linea base JSON.
+//
+// Codigos de salida: 0 correcto, 1 regresion respecto a la linea base, 2 error de uso o de datos.
+
+#include "Baseline.h"
+#include "Scenarios.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum Phase {
+    PHASE_PLAYER_MOVE,
+    PHASE_ENEMY_AI,
+    PHASE_ENEMY_MOVE,
+    PHASE_BOUNDARIES,
+    PHASE_FOOD,
+    PHASE_COLLISIONS,
+    PHASE_NO_EAT,
+    PHASE_SPAWNS,
+    PHASE_COUNT
+};
+
+const char* const kPhaseNames[PHASE_COUNT] = {
+    "player_move", "enemy_ai", "enemy_move", "boundaries", "food", "collisions", "no_eat", "spawns"
+};
+
+struct Options {
+    int ticks;
+    int reps;
+    int warmup;
+    std::string scenario;
+    std::string baselinePath;
+    std::string writePath;
+    GateSettings gate;
+    bool list;
+};
+
+// Nanosegundos acumulados de una repeticion
+struct RepTotals {
+    double update;
+    double render;
+    double phases[PHASE_COUNT];
+    std::uint64_t checksum;
+    int restarts;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+template <typename F>
+double TimeNs(F&& f) {
+    Clock::time_point start = Clock::now();
+    f();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Reproduce Game::Update midiendo cada fase por separado. Si Update cambia hay que actualizarla;
+// la comparacion de checksums en RunScenario lo detecta.
+void PhasedUpdate(Game& game, double* phases) {
+    if (game.gameOver)
+        return;
+    phases[PHASE_PLAYER_MOVE] += TimeNs([&] { game.player->Update(); });
+    if (game.enemy) {
+        phases[PHASE_ENEMY_AI] += TimeNs([&] { game.UpdateEnemy(); });
+        phases[PHASE_ENEMY_MOVE] += TimeNs([&] { game.enemy->Update(); });
+    }
+    phases[PHASE_BOUNDARIES] += TimeNs([&] { game.CheckBoundaries(); });
+    if (game.gameOver)
+        return;
+    phases[PHASE_FOOD] += TimeNs([&] { game.ProcessFood(); });
+    phases[PHASE_COLLISIONS] += TimeNs([&] { game.CheckSnakeCollisions(); });
+    phases[PHASE_NO_EAT] += TimeNs([&] { game.CheckNoEatTimeout(); });
+    phases[PHASE_SPAWNS] += TimeNs([&] { game.ProcessSpawns(); });
+}
+
+// Una repeticion: parte del estado inicial y simula `ticks` ticks. Si la partida termina (o muere
+// el enemigo, segun el escenario) se reinicia fuera de la medicion para no medir otra carga.
+RepTotals RunRepetition(Game& game, const Scenario& scenario, int ticks, bool phased, HeadlessSurface& surface) {
+    RepTotals totals = {};
+    RestoreScenario(game, scenario);
+    for (int tick = 0; tick < ticks; tick++) {
+        if (game.gameOver || (scenario.restartOnEnemyDeath && !game.enemy)) {
+            RestoreScenario(game, scenario);
+            totals.restarts++;
+        }
+        HeadlessTickCount() += scenario.tickMs;
+        if (scenario.driver)
+            scenario.driver(game);
+        if (phased) {
+            PhasedUpdate(game, totals.phases);
+        }
+        else {
+            totals.update += TimeNs([&] { game.Update(); });
+            totals.render += TimeNs([&] { game.Render(&surface); });
+        }
+    }
+    totals.checksum = StateChecksum(game);
+    return totals;
+}
+
+// Mide un escenario en dos pasadas (Update+Render completos y fase a fase) y anade sus metricas.
+// Devuelve false si las dos pasadas no terminan en el mismo estado.
+bool RunScenario(const Scenario& scenario, const Options& opt, std::vector<MetricSummary>& metrics,
+    std::uint64_t& checksum) {
+    Game game;
+    HeadlessSurface surface(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+    std::vector<double> update, render;
+    std::vector<double> phases[PHASE_COUNT];
+    int restarts = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        bool phased = (pass == 1);
+        for (int i = 0; i < opt.warmup; i++)
+            RunRepetition(game, scenario, opt.ticks, phased, surface);
+        for (int i = 0; i < opt.reps; i++) {
+            RepTotals t = RunRepetition(game, scenario, opt.ticks, phased, surface);
+            if (!phased && i == 0) {
+                checksum = t.checksum;
+                restarts = t.restarts;
+            }
+            if (t.checksum != checksum) {
+                std::fprintf(stderr, "%s: el estado final no coincide entre repeticiones (%s); "
+                    "PhasedUpdate y Game::Update ya no hacen lo mismo?\n",
+                    scenario.name.c_str(), phased ? "fase a fase" : "Update");
+                return false;
+            }
+            if (phased) {
+                for (int p = 0; p < PHASE_COUNT; p++)
+                    phases[p].push_back(t.phases[p] / opt.ticks);
+            }
+            else {
+                update.push_back(t.update / opt.ticks);
+                render.push_back(t.render / opt.ticks);
+            }
+        }
+    }
+
+    std::printf("%-14s %s (%d reinicios por repeticion)\n", scenario.name.c_str(),
+        scenario.description.c_str(), restarts);
+    metrics.push_back(Summarize(scenario.name + "/update", update));
+    for (int p = 0; p < PHASE_COUNT; p++)
+        metrics.push_back(Summarize(scenario.name + "/update." + kPhaseNames[p], phases[p]));
+    metrics.push_back(Summarize(scenario.name + "/render", render));
+    return true;
+}
+
+void PrintUsage() {
+    std::printf(
+        "Uso: snake_bench [opciones]\n"
+        "  --list                  Muestra los escenarios y termina\n"
+        "  --scenario NOMBRE       Ejecuta solo ese escenario\n"
+        "  --ticks N               Ticks por repeticion (por defecto 200)\n"
+        "  --reps N                Repeticiones medidas (por defecto 25)\n"
+        "  --warmup N              Repeticiones de calentamiento descartadas (por defecto 3)\n"
+        "  --baseline FICHERO      Compara con la linea base y falla si hay regresiones\n"
+        "  --write-baseline FICHERO  Guarda los resultados como nueva linea base\n"
+        "  --threshold X           Aumento relativo tolerado de la mediana (por defecto 0.15)\n"
+        "  --min-delta-ns X        Diferencia minima en ns/tick para contar (por defecto 25)\n"
+        "  --t-critical X          Umbral del t de Welch (por defecto 3)\n");
+}
+
+bool ParseInt(const char* text, int& out) {
+    char* end = nullptr;
+    long value = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || value < 0 || value > 1000000)
+        return false;
+    out = static_cast<int>(value);
+    return true;
+}
+
+bool ParseDouble(const char* text, double& out) {
+    char* end = nullptr;
+    out = std::strtod(text, &end);
+    return end != text && *end == '\0' && out >= 0;
+}
+
+bool TakesValue(const char* arg) {
+    static const char* const names[] = { "--scenario", "--ticks", "--reps", "--warmup", "--baseline",
+        "--write-baseline", "--threshold", "--min-delta-ns", "--t-critical" };
+    for (const char* name : names) {
+        if (std::strcmp(arg, name) == 0)
+            return true;
+    }
+    return false;
+}
+
+bool ParseOptions(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        bool ok = true;
+        if (std::strcmp(arg, "--list") == 0) { opt.list = true; continue; }
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0)
+            return false;
+        if (!TakesValue(arg)) {
+            std::fprintf(stderr, "Opcion desconocida: %s\n", arg);
+            return false;
+        }
+        if (!value) {
+            std::fprintf(stderr, "Falta el valor de %s\n", arg);
+            return false;
+        }
+        if (std::strcmp(arg, "--scenario") == 0) opt.scenario = value;
+        else if (std::strcmp(arg, "--ticks") == 0) ok = ParseInt(value, opt.ticks) && opt.ticks > 0;
+        else if (std::strcmp(arg, "--reps") == 0) ok = ParseInt(value, opt.reps) && opt.reps > 1;
+        else if (std::strcmp(arg, "--warmup") == 0) ok = ParseInt(value, opt.warmup);
+        else if (std::strcmp(arg, "--baseline") == 0) opt.baselinePath = value;
+        else if (std::strcmp(arg, "--write-baseline") == 0) opt.writePath = value;
+        else if (std::strcmp(arg, "--threshold") == 0) ok = ParseDouble(value, opt.gate.threshold);
+        else if (std::strcmp(arg, "--min-delta-ns") == 0) ok = ParseDouble(value, opt.gate.minDeltaNs);
+        else if (std::strcmp(arg, "--t-critical") == 0) ok = ParseDouble(value, opt.gate.tCritical);
+        if (!ok) {
+            std::fprintf(stderr, "Valor no valido para %s: %s\n", arg, value);
+            return false;
+        }
+        i++;
+    }
+    return true;
+}
+
+const char* StatusText(CompareStatus status) {
+    switch (status) {
+    case COMPARE_FASTER:     return "mas rapido";
+    case COMPARE_REGRESSION: return "REGRESION";
+    case COMPARE_NEW:        return "nuevo";
+    default:                 return "ok";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    opt.ticks = 200;
+    opt.reps = 25;
+    opt.warmup = 3;
+    opt.gate.threshold = 0.15;
+    opt.gate.minDeltaNs = 25;
+    opt.gate.tCritical = 3;
+    opt.list = false;
+    if (!ParseOptions(argc, argv, opt)) {
+        PrintUsage();
+        return 2;
+    }
+
+    std::vector<Scenario> scenarios = BuildScenarios();
+    if (opt.list) {
+        for (auto& s : scenarios)
+            std::printf("%-14s %s\n", s.name.c_str(), s.description.c_str());
+        return 0;
+    }
+
+    Baseline baseline;
+    std::string error;
+    if (!opt.baselinePath.empty()) {
+        if (!LoadBaseline(opt.baselinePath, baseline, error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 2;
+        }
+        if (baseline.ticks != opt.ticks) {
+            std::fprintf(stderr, "La linea base usa --ticks %d; no es comparable con --ticks %d\n",
+                baseline.ticks, opt.ticks);
+            return 2;
+        }
+    }
+
+    Baseline current;
+    current.ticks = opt.ticks;
+    current.reps = opt.reps;
+    current.warmup = opt.warmup;
+    bool found = false;
+    for (auto& s : scenarios) {
+        if (!opt.scenario.empty() && s.name != opt.scenario)
+            continue;
+        found = true;
+        std::uint64_t checksum = 0;
+        if (!RunScenario(s, opt, current.metrics, checksum))
+            return 2;
+        current.checksums.push_back({ s.name, checksum });
+    }
+    if (!found) {
+        std::fprintf(stderr, "Escenario desconocido: %s (ver --list)\n", opt.scenario.c_str());
+        return 2;
+    }
+
+    int status = 0;
+    if (!opt.baselinePath.empty()) {
+        // Si el estado final difiere la carga ya no es la misma (otra libc, otra logica) y los tiempos no son comparables
+        for (auto& c : current.checksums) {
+            for (auto& b : baseline.checksums) {
+                if (b.first == c.first && b.second != c.second) {
+                    std::fprintf(stderr, "%s: la simulacion ya no coincide con la linea base; regenerala con "
+                        "--write-baseline\n", c.first.c_str());
+                    status = 2;
+                }
+            }
+        }
+        if (status != 0)
+            return status;
+    }
+
+    std::printf("\n%-34s %12s %12s %10s %10s", "metrica (ns/tick)", "mediana", "desv", "min", "max");
+    if (!opt.baselinePath.empty())
+        std::printf(" %12s %9s %8s  %s", "base", "cambio", "t", "estado");
+    std::printf("\n");
+
+    std::vector<Comparison> comparisons;
+    if (!opt.baselinePath.empty())
+        comparisons = CompareToBaseline(baseline, current.metrics, opt.gate);
+    for (size_t i = 0; i < current.metrics.size(); i++) {
+        const MetricSummary& m = current.metrics[i];
+        std::printf("%-34s %12.1f %12.1f %10.1f %10.1f", m.name.c_str(), m.median, m.stddev, m.min, m.max);
+        if (!comparisons.empty()) {
+            const Comparison& c = comparisons[i];
+            if (c.status == COMPARE_NEW)
+                std::printf(" %12s %9s %8s  %s", "-", "-", "-", StatusText(c.status));
+            else
+                std::printf(" %12.1f %+8.1f%% %8.2f  %s", c.baseMedian, c.change * 100, c.tStat, StatusText(c.status));
+            if (c.status == COMPARE_REGRESSION)
+                status = 1;
+        }
+        std::printf("\n");
+    }
+
+    if (!opt.writePath.empty()) {
+        if (!WriteBaseline(opt.writePath, current, error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 2;
+        }
+        std::printf("\nLinea base guardada en %s\n", opt.writePath.c_str());
+    }
+    if (status == 1)
+        std::printf("\nRegresion por encima del %.0f%% en al menos una ruta critica\n", opt.gate.threshold * 100);
+    return status;
+}